@@ -33,12 +33,25 @@
 
 #include "config.h"
 
+#include <ctype.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
 #include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#endif
 
 #ifdef CURSES_HAVE_CURSES_H
 #include <curses.h>
@@ -52,6 +65,58 @@
 #error No curses include file found
 #endif
 
+/** size of the input buffer, including its NUL byte */
+#define BUF_SIZE 1024
+
+/** height of the off-screen window used when not interactive */
+#define PRINT_LINES 24
+
+/** width of the off-screen window, wide enough for the widest line */
+#define PRINT_COLS ((BUF_SIZE * 2) + 8 /*prefix*/)
+
+/** narrowest the off-screen window gets, wide enough for the typed values */
+#define PRINT_COLS_MIN 64
+
+/** maximum number of encodings of a value that are searched for */
+#define FIND_PATTERNS 6
+
+/** size of the longest encoding, a time string, including its NUL byte */
+#define FIND_PATTERN_SIZE 32
+
+/** maximum number of matcher states, one per pattern byte plus the root */
+#define FIND_STATES ((FIND_PATTERNS * FIND_PATTERN_SIZE) + 1)
+
+/** One encoding of the value being searched for. */
+struct find_pattern
+{
+    const char *p_name; /**< name of the encoding, printed with matches */
+    char buf[FIND_PATTERN_SIZE];    /**< bytes to search for */
+    size_t len; /**< number of bytes in buf */
+};
+
+/**
+ * Aho-Corasick automaton over all of the patterns, flattened into a table of
+ * transitions so each input byte costs one lookup.
+ */
+struct find_matcher
+{
+    unsigned short next[FIND_STATES][UCHAR_MAX + 1];    /**< transitions */
+    unsigned matches[FIND_STATES];  /**< bitmask of patterns ending here */
+};
+
+/** Files to search, shared by all of the searching threads. */
+struct find_job
+{
+    const struct find_matcher *p_matcher;   /**< matcher to search with */
+    const struct find_pattern *p_patterns;  /**< patterns being matched */
+    char **pp_paths;    /**< paths of files to search */
+    int paths_len;  /**< number of paths in pp_paths */
+    int paths_next; /**< index of next path to search */
+    int rc; /**< 0 if no errors; !0 otherwise */
+    int stop;   /**< !0 if output failed and searching should stop */
+    pthread_mutex_t mutex;  /**< protects paths_next, rc and stop */
+};
+
 /**
  * Paint buffer contets to the current line as a string.
  * @param p_window  pointer to window to paint to
@@ -92,39 +157,22 @@ int paint_string(WINDOW *p_window, int *p_y, int x_max, const char *p_buf)
 }
 
 /**
- * If buffer contains a series of hex digits, interpret them as ascii and
- * paint them to the current line.
- * @param p_window  pointer to window to paint to
- * @param p_y   pointer to number of line to paint to, will be incremented if
- *              line was painted
- * @param x_max width of the line
- * @param p_buf pointer to buffer to paint
+ * If buffer contains a series of hex digits, decode each pair of them into a
+ * byte.  A trailing, unpaired hex digit is ignored.
+ * @param p_buf pointer to buffer to decode
  * @param p_buf_end pointer to the NUL byte that terminates p_buf
- * @return 0 if no errors; !0 otherwise
+ * @param p_bytes   pointer to array to decode into, must hold at least
+ *                  (p_buf_end - p_buf) / 2 bytes
+ * @return number of bytes decoded if buffer only contains hex digits;
+ *         -1 otherwise
  */
-int paint_char(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
-        const char *p_buf_end)
+int decode_hex(const char *p_buf, const char *p_buf_end,
+        unsigned char *p_bytes)
 {
-    int x;
-
-    if(p_buf == p_buf_end)
-        return 0;
-
-    /* print prefix at begining of line */
-    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, "C: "))
-    {
-        fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
-        return -1;
-    }
-
-    x = getcurx(p_window);
-
-    /* don't go past end of the line */
-    if(((x_max - x) * 2) < (p_buf_end - p_buf))
-        p_buf_end = p_buf + ((x_max - x) * 2);
+    int bytes_len;
 
     /* for each two characters */
-    for(; (p_buf + 1) < p_buf_end; p_buf += 2)
+    for(bytes_len = 0; (p_buf + 1) < p_buf_end; p_buf += 2, ++bytes_len)
     {
         int i;
         int c;
@@ -141,13 +189,61 @@ int paint_char(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
             else if((p_buf[i] >= 'A') && (p_buf[i] <= 'F'))
                 c += p_buf[i] - 'A' + 10;
             else
-                return 0;
+                return -1;
         }
 
-        if((c < CHAR_MIN) || (c > CHAR_MAX))
+        p_bytes[bytes_len] = (unsigned char)c;
+    }
+
+    return bytes_len;
+}
+
+/**
+ * If bytes were decoded from the buffer and are all printable, paint them to
+ * the current line as characters.
+ * @param p_window  pointer to window to paint to
+ * @param p_y   pointer to number of line to paint to, will be incremented if
+ *              line was painted
+ * @param x_max width of the line
+ * @param p_prefix  pointer to prefix to paint at the start of the line
+ * @param p_bytes   pointer to bytes decoded from the buffer
+ * @param bytes_len number of bytes in p_bytes, -1 if buffer wasn't hex
+ * @return 0 if no errors; !0 otherwise
+ */
+int paint_char(WINDOW *p_window, int *p_y, int x_max, const char *p_prefix,
+        const unsigned char *p_bytes, int bytes_len)
+{
+    int x;
+    const unsigned char *p_bytes_end;
+
+    if(bytes_len <= 0)
+        return 0;
+
+    /* control bytes would move the cursor, so check before painting */
+    for(p_bytes_end = p_bytes + bytes_len; p_bytes_end > p_bytes;
+            --p_bytes_end)
+    {
+        if((p_bytes_end[-1] > CHAR_MAX) || !isprint(p_bytes_end[-1]))
             return 0;
+    }
+    p_bytes_end = p_bytes + bytes_len;
+
+    /* print prefix at begining of line */
+    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, p_prefix))
+    {
+        fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
+        return -1;
+    }
+
+    x = getcurx(p_window);
 
-        if(ERR == waddch(p_window, (char)c))
+    /* don't go past end of the line */
+    if((x_max - x) < bytes_len)
+        p_bytes_end = p_bytes + (x_max - x);
+
+    for(; p_bytes < p_bytes_end; ++p_bytes)
+    {
+        if(ERR == waddch(p_window, (char)*p_bytes))
         {
             fprintf(stderr, "%s: mvwprintw failed\n", __func__);
             return -1;
@@ -170,12 +266,13 @@ int paint_char(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
  * @param p_y   pointer to number of line to paint to, will be incremented if
  *              line was painted
  * @param x_max width of the line
+ * @param p_prefix  pointer to prefix to paint at the start of the line
  * @param p_buf pointer to buffer to paint
- * @param p_buf_end pointer to the NUL byte that terminates p_buf
+ * @param p_buf_end pointer to the end of p_buf
  * @return 0 if no errors; !0 otherwise
  */
-int paint_ascii(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
-        const char *p_buf_end)
+int paint_ascii(WINDOW *p_window, int *p_y, int x_max, const char *p_prefix,
+        const char *p_buf, const char *p_buf_end)
 {
     int x;
 
@@ -183,7 +280,7 @@ int paint_ascii(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
         return 0;
 
     /* print prefix at begining of line */
-    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, "A: "))
+    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, p_prefix))
     {
         fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
         return -1;
@@ -198,7 +295,7 @@ int paint_ascii(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
     /* print each character's ascii value in hex */
     for(; p_buf < p_buf_end; ++p_buf)
     {
-        if(ERR == wprintw(p_window, "%02x", (unsigned)*p_buf))
+        if(ERR == wprintw(p_window, "%02x", (unsigned char)*p_buf))
         {
             fprintf(stderr, "%s: mvwprintw failed\n", __func__);
             return -1;
@@ -222,21 +319,44 @@ int paint_ascii(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
  *              line was painted
  * @param x_max width of the line
  * @param p_buf pointer to buffer to paint
+ * @param p_bytes   pointer to bytes decoded from the buffer
+ * @param bytes_len number of bytes in p_bytes, -1 if buffer wasn't an even
+ *                  number of hex digits
  * @return 0 if no errors; !0 otherwise
  */
-int paint_dec(WINDOW *p_window, int *p_y, int x_max, const char *p_buf)
+int paint_dec(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
+        const unsigned char *p_bytes, int bytes_len)
 {
     char *p_buf_parse_end;
     long long val;
     char buf[32 /*larger then prefix + LLONG_MAX + 1 NUL byte*/];
     int rc;
 
-    /* read buffer in as hex */
-    errno = 0;
-    val = strtoll(p_buf, &p_buf_parse_end, 16 /*base*/);
-    if((p_buf == p_buf_parse_end) || (*p_buf_parse_end != '\0')
-            || (errno == ERANGE))
-        return 0;
+    if(bytes_len >= 0)
+    {
+        unsigned long long val_bytes;
+        int i;
+
+        /* B: already shows the value of integer type widths */
+        if(!bytes_len || (bytes_len > 8) || (bytes_len == 1)
+                || (bytes_len == 2) || (bytes_len == 4) || (bytes_len == 8))
+            return 0;
+
+        /* read decoded bytes most significant first */
+        val_bytes = 0;
+        for(i = 0; i < bytes_len; ++i)
+            val_bytes = (val_bytes << 8) | p_bytes[i];
+        val = (long long)val_bytes;
+    }
+    else
+    {
+        /* read buffer in as hex */
+        errno = 0;
+        val = strtoll(p_buf, &p_buf_parse_end, 16 /*base*/);
+        if((p_buf == p_buf_parse_end) || (*p_buf_parse_end != '\0')
+                || (errno == ERANGE))
+            return 0;
+    }
 
     /* format buffer's number as decimal */
     if((rc = snprintf(buf, sizeof(buf), "D: %lld", val)) < 0)
@@ -518,141 +638,555 @@ int paint_seconds_time(WINDOW *p_window, int *p_y, int x_max, const char *p_buf)
 }
 
 /**
- * Interpret buffer in many different ways and print each one to its own line.
+ * If bytes are as wide as an integer type, read them as an unsigned integer
+ * in both byte orders.
+ * @param p_bytes   pointer to bytes decoded from the buffer
+ * @param bytes_len number of bytes in p_bytes
+ * @param p_le  pointer to integer read least significant byte first
+ * @param p_be  pointer to integer read most significant byte first
+ * @return 0 if bytes were read; !0 otherwise
+ */
+int decode_int(const unsigned char *p_bytes, int bytes_len, uint64_t *p_le,
+        uint64_t *p_be)
+{
+    int i;
+
+    if((bytes_len != 1) && (bytes_len != 2) && (bytes_len != 4)
+            && (bytes_len != 8))
+        return -1;
+
+    /* build up both byte orders in one pass */
+    *p_le = 0;
+    *p_be = 0;
+    for(i = 0; i < bytes_len; ++i)
+    {
+        *p_le |= (uint64_t)p_bytes[i] << (i * 8);
+        *p_be = (*p_be << 8) | p_bytes[i];
+    }
+
+    return 0;
+}
+
+/**
+ * Paint an integer to the current line as both signed and unsigned.
  * @param p_window  pointer to window to paint to
- * @param p_buf pointer to buffer to paint
- * @param p_buf_end pointer to the NUL byte that terminates p_buf
+ * @param p_y   pointer to number of line to paint to, will be incremented if
+ *              line was painted
+ * @param x_max width of the line
+ * @param p_prefix  pointer to prefix to paint at the start of the line
+ * @param val   unsigned value of the integer
+ * @param bytes_len width of the integer in bytes
  * @return 0 if no errors; !0 otherwise
  */
-int paint_window(WINDOW *p_window, const char *p_buf, const char *p_buf_end)
+int paint_int(WINDOW *p_window, int *p_y, int x_max, const char *p_prefix,
+        uint64_t val, int bytes_len)
 {
-    int y;
-    int y_max;
-    int x_max;
-
-    /* verify window height */
-    getmaxyx(p_window, y_max, x_max);
-    y = 1;  /* paint top row last */
+    int bits;
+    int64_t val_signed;
+    char buf[48 /*larger then prefix + LLONG_MIN + ULLONG_MAX + 1 NUL byte*/];
+    int rc;
 
-    /* try to print out as many interpretations as will fit */
+    /* sign extend from the integer's width */
+    bits = bytes_len * 8;
+    if((bits < 64) && ((val >> (bits - 1)) & 1))
+        val_signed = (int64_t)(val | (~(uint64_t)0 << bits));
+    else
+        val_signed = (int64_t)val;
 
-    if((y < y_max) && paint_char(p_window, &y, x_max, p_buf, p_buf_end))
+    if((rc = snprintf(buf, sizeof(buf), "%s%lld %llu", p_prefix,
+                    (long long)val_signed, (unsigned long long)val)) < 0)
     {
-        fprintf(stderr, "%s: paint_char failed\n", __func__);
+        fprintf(stderr, "%s: snprintf failed\n", __func__);
         return -1;
     }
 
-    if((y < y_max) && paint_ascii(p_window, &y, x_max, p_buf, p_buf_end))
+    /* if too long */
+    if(rc > x_max)
+        return 0;
+
+    /* print at begining of line */
+    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, buf))
     {
-        fprintf(stderr, "%s: paint_ascii failed\n", __func__);
+        fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
         return -1;
     }
 
-    if((y < y_max) && paint_dec(p_window, &y, x_max, p_buf))
+    /* if we're still on the same line, clear the rest of it */
+    if((*p_y == getcury(p_window)) && (ERR == wclrtoeol(p_window)))
     {
-        fprintf(stderr, "%s: paint_dec failed\n", __func__);
+        fprintf(stderr, "%s: wclrtoeol failed\n", __func__);
         return -1;
     }
+    ++*p_y;
+    return 0;
+}
 
-    if((y < y_max) && paint_hex(p_window, &y, x_max, p_buf))
+/**
+ * Interpret the bits of an integer as an IEEE-754 floating point number.
+ * @param val   unsigned value of the integer
+ * @param bytes_len width of the integer in bytes
+ * @param p_float   pointer to the floating point number
+ * @return 0 if the integer is as wide as a floating point type; !0 otherwise
+ */
+int decode_float(uint64_t val, int bytes_len, double *p_float)
+{
+    switch(bytes_len)
     {
-        fprintf(stderr, "%s: paint_hex failed\n", __func__);
-        return -1;
+        case 2:
+        {
+            unsigned exponent;
+            unsigned mantissa;
+
+            /* half precision has no native type, so unpack it by hand */
+            exponent = (val >> 10) & 0x1f;
+            mantissa = val & 0x3ff;
+            if(exponent == 0)
+                *p_float = ldexp(mantissa, -24 /*subnormal*/);
+            else if(exponent == 0x1f)
+                *p_float = mantissa ? NAN : INFINITY;
+            else
+                *p_float = ldexp(mantissa | 0x400 /*implicit 1*/,
+                        (int)exponent - 25 /*bias + mantissa bits*/);
+
+            if(val & 0x8000)
+                *p_float = -*p_float;
+            return 0;
+        }
+
+        case 4:
+        {
+            uint32_t val32;
+            float f;
+
+            val32 = (uint32_t)val;
+            memcpy(&f, &val32, sizeof(f));
+            *p_float = f;
+            return 0;
+        }
+
+        case 8:
+        {
+            memcpy(p_float, &val, sizeof(*p_float));
+            return 0;
+        }
     }
 
-    if((y < y_max) && paint_time(p_window, &y, x_max, p_buf))
+    return -1;
+}
+
+/**
+ * If bytes are as wide as a floating point type, paint them to the current
+ * line as floating point numbers read in both byte orders.
+ * @param p_window  pointer to window to paint to
+ * @param p_y   pointer to number of line to paint to, will be incremented if
+ *              line was painted
+ * @param x_max width of the line
+ * @param le    integer read least significant byte first
+ * @param be    integer read most significant byte first
+ * @param bytes_len number of bytes the integers were read from
+ * @return 0 if no errors; !0 otherwise
+ */
+int paint_float(WINDOW *p_window, int *p_y, int x_max, uint64_t le,
+        uint64_t be, int bytes_len)
+{
+    double le_float;
+    double be_float;
+    int precision;
+    char buf[64 /*larger then prefix + 2 %.17g doubles + 1 NUL byte*/];
+    int rc;
+
+    if(decode_float(le, bytes_len, &le_float)
+            || decode_float(be, bytes_len, &be_float))
+        return 0;
+
+    /* enough significant digits to tell apart every value of the width */
+    if(bytes_len == 2)
+        precision = 5;
+    else if(bytes_len == 4)
+        precision = 9;
+    else
+        precision = 17;
+
+    if((rc = snprintf(buf, sizeof(buf), "F: %.*g %.*g", precision, le_float,
+                    precision, be_float)) < 0)
     {
-        fprintf(stderr, "%s: paint_time failed\n", __func__);
+        fprintf(stderr, "%s: snprintf failed\n", __func__);
         return -1;
     }
 
-    if((y < y_max) && paint_seconds(p_window, &y, x_max, p_buf))
+    /* if too long */
+    if(rc > x_max)
+        return 0;
+
+    /* print at begining of line */
+    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, buf))
     {
-        fprintf(stderr, "%s: paint_seconds failed\n", __func__);
+        fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
         return -1;
     }
 
-    if((y < y_max) && paint_seconds_time(p_window, &y, x_max, p_buf))
+    /* if we're still on the same line, clear the rest of it */
+    if((*p_y == getcury(p_window)) && (ERR == wclrtoeol(p_window)))
     {
-        fprintf(stderr, "%s: paint_seconds_time failed\n", __func__);
+        fprintf(stderr, "%s: wclrtoeol failed\n", __func__);
         return -1;
     }
+    ++*p_y;
+    return 0;
+}
 
-    /* clear rest of screen */
-    if(ERR == wclrtobot(p_window))
-    {
-        fprintf(stderr, "%s: wclrtobot failed\n", __func__);
+/**
+ * Look up the value of a base64 or base64url digit.
+ * @param c character to look up
+ * @return value of c if it's a digit; -1 otherwise
+ */
+int base64_value(char c)
+{
+    if((c >= 'A') && (c <= 'Z'))
+        return c - 'A';
+    else if((c >= 'a') && (c <= 'z'))
+        return c - 'a' + 26;
+    else if((c >= '0') && (c <= '9'))
+        return c - '0' + 52;
+    else if((c == '+') || (c == '-' /*base64url*/))
+        return 62;
+    else if((c == '/') || (c == '_' /*base64url*/))
+        return 63;
+    return -1;
+}
+
+/**
+ * If buffer contains base64 or base64url, decode it into bytes.  Padding is
+ * optional, but if present it must complete the last group of 4 digits.
+ * @param p_buf pointer to buffer to decode
+ * @param p_buf_end pointer to the NUL byte that terminates p_buf
+ * @param p_bytes   pointer to array to decode into, must hold at least
+ *                  (p_buf_end - p_buf) * 3 / 4 bytes
+ * @return number of bytes decoded if buffer is valid base64; -1 otherwise
+ */
+int decode_base64(const char *p_buf, const char *p_buf_end,
+        unsigned char *p_bytes)
+{
+    const char *p_digits_end;
+    unsigned bits;
+    int bits_len;
+    int bytes_len;
+
+    /* find padding */
+    for(p_digits_end = p_buf_end;
+            (p_digits_end > p_buf) && (p_digits_end[-1] == '=');
+            --p_digits_end);
+
+    /* if no digits, too much padding, or a digit can't make a whole byte */
+    if((p_digits_end == p_buf) || ((p_buf_end - p_digits_end) > 2)
+            || (((p_digits_end - p_buf) % 4) == 1))
         return -1;
-    }
 
-    y = 0;  /* fill in top row */
-    if((y < y_max) && paint_string(p_window, &y, x_max, p_buf))
-    {
-        fprintf(stderr, "%s: paint_string failed\n", __func__);
+    /* if padded, the padding must finish the last group */
+    if((p_digits_end != p_buf_end) && ((p_buf_end - p_buf) % 4))
         return -1;
-    }
 
-    /* draw to screen */
-    if(ERR == wrefresh(p_window))
+    /* validate and decode each digit, emitting bytes as they fill */
+    bits = 0;
+    bits_len = 0;
+    for(bytes_len = 0; p_buf < p_digits_end; ++p_buf)
     {
-        fprintf(stderr, "%s: wrefresh failed\n", __func__);
-        return -1;
+        int val;
+
+        if((val = base64_value(*p_buf)) < 0)
+            return -1;
+
+        bits = (bits << 6) | val;
+        bits_len += 6;
+        if(bits_len >= 8)
+        {
+            bits_len -= 8;
+            p_bytes[bytes_len++] = (unsigned char)(bits >> bits_len);
+            bits &= (1u << bits_len) - 1;
+        }
     }
 
-    return 0;
+    /* unused trailing bits must be zero */
+    if(bits)
+        return -1;
+
+    return bytes_len;
 }
 
 /**
- * Read characters and print many different interpretations.
- * @param p_window  pointer to window to use
+ * Paint buffer contents to the current line encoded as base64.
+ * @param p_window  pointer to window to paint to
+ * @param p_y   pointer to number of line to paint to, will be incremented if
+ *              line was painted
+ * @param x_max width of the line
+ * @param p_buf pointer to buffer to paint
+ * @param p_buf_end pointer to the NUL byte that terminates p_buf
+ * @return 0 if no errors; !0 otherwise
  */
-int main_int(WINDOW *p_window)
+int paint_base64(WINDOW *p_window, int *p_y, int x_max, const char *p_buf,
+        const char *p_buf_end)
 {
-    int c;
-    char buf[1024];
-    char *p_buf;
+    static const char digits[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char buf[((BUF_SIZE + 2) / 3) * 4 + 1 /*NUL byte*/];
+    char *p_out;
+    int x;
 
-    /* configure curses */
+    if(p_buf == p_buf_end)
+        return 0;
 
-    if(ERR == cbreak())
+    /* encode each group of 3 bytes as 4 digits, padding the last group */
+    for(p_out = buf; p_buf < p_buf_end; p_buf += 3, p_out += 4)
     {
-        fprintf(stderr, "%s: cbreak failed\n", __func__);
-        return -1;
+        unsigned long group;
+        int group_len;
+
+        group_len = ((p_buf_end - p_buf) < 3) ? (p_buf_end - p_buf) : 3;
+        group = (unsigned long)(unsigned char)p_buf[0] << 16;
+        if(group_len > 1)
+            group |= (unsigned long)(unsigned char)p_buf[1] << 8;
+        if(group_len > 2)
+            group |= (unsigned char)p_buf[2];
+
+        p_out[0] = digits[(group >> 18) & 0x3f];
+        p_out[1] = digits[(group >> 12) & 0x3f];
+        p_out[2] = (group_len > 1) ? digits[(group >> 6) & 0x3f] : '=';
+        p_out[3] = (group_len > 2) ? digits[group & 0x3f] : '=';
     }
+    *p_out = '\0';
 
-    if(ERR == noecho())
+    /* print prefix at begining of line */
+    if(ERR == mvwaddstr(p_window, *p_y, 0 /*start of line*/, "64: "))
     {
-        fprintf(stderr, "%s: noecho failed\n", __func__);
+        fprintf(stderr, "%s: mvwaddstr failed\n", __func__);
         return -1;
     }
 
-    if(ERR == nonl())
-    {
-        fprintf(stderr, "%s: nonl failed\n", __func__);
-        return -1;
-    }
+    x = getcurx(p_window);
 
-    if(ERR == intrflush(p_window, FALSE))
+    /* print encoding up to end of line */
+    if(ERR == waddnstr(p_window, buf, x_max - x))
     {
-        fprintf(stderr, "%s: intrflush failed\n", __func__);
+        fprintf(stderr, "%s: waddnstr failed\n", __func__);
         return -1;
     }
 
-    if(ERR == keypad(p_window, TRUE))
+    /* if we're still on the same line, clear the rest of it */
+    if((*p_y == getcury(p_window)) && (ERR == wclrtoeol(p_window)))
     {
-        fprintf(stderr, "%s: keypad failed\n", __func__);
+        fprintf(stderr, "%s: wclrtoeol failed\n", __func__);
         return -1;
     }
+    ++*p_y;
+    return 0;
+}
 
-    /* initial, empty paint */
+/**
+ * Interpret buffer in many different ways and print each one to its own line.
+ * The window isn't refreshed, that's up to the caller.
+ * @param p_window  pointer to window to paint to
+ * @param p_buf pointer to buffer to paint
+ * @param p_buf_end pointer to the NUL byte that terminates p_buf
+ * @param p_lines   pointer to number of lines painted, may be NULL
+ * @return 0 if no errors; !0 otherwise
+ */
+int paint_window(WINDOW *p_window, const char *p_buf, const char *p_buf_end,
+        int *p_lines)
+{
+    int y;
+    int y_max;
+    int x_max;
+    unsigned char bytes[BUF_SIZE / 2];
+    int bytes_len;
+    uint64_t le;
+    uint64_t be;
+    unsigned char base64_bytes[(BUF_SIZE * 3) / 4];
+    int base64_bytes_len;
+
+    /* verify window height */
+    getmaxyx(p_window, y_max, x_max);
+    y = 1;  /* paint top row last */
+
+    /* decode hex once for all of the byte interpretations */
+    bytes_len = decode_hex(p_buf, p_buf_end, bytes);
+
+    /* try to print out as many interpretations as will fit */
+
+    if((y < y_max) && paint_char(p_window, &y, x_max, "C: ", bytes,
+                bytes_len))
+    {
+        fprintf(stderr, "%s: paint_char failed\n", __func__);
+        return -1;
+    }
+
+    /* only read typed values when there's no unpaired hex digit */
+    if(((p_buf_end - p_buf) % 2 == 0)
+            && !decode_int(bytes, bytes_len, &le, &be))
+    {
+        if((y < y_max) && paint_int(p_window, &y, x_max, "L: ", le,
+                    bytes_len))
+        {
+            fprintf(stderr, "%s: paint_int failed\n", __func__);
+            return -1;
+        }
+
+        if((y < y_max) && paint_int(p_window, &y, x_max, "B: ", be,
+                    bytes_len))
+        {
+            fprintf(stderr, "%s: paint_int failed\n", __func__);
+            return -1;
+        }
+
+        if((y < y_max) && paint_float(p_window, &y, x_max, le, be,
+                    bytes_len))
+        {
+            fprintf(stderr, "%s: paint_float failed\n", __func__);
+            return -1;
+        }
+    }
+
+    if((y < y_max) && paint_ascii(p_window, &y, x_max, "A: ", p_buf,
+                p_buf_end))
+    {
+        fprintf(stderr, "%s: paint_ascii failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_dec(p_window, &y, x_max, p_buf, bytes,
+                ((p_buf_end - p_buf) % 2 == 0) ? bytes_len : -1))
+    {
+        fprintf(stderr, "%s: paint_dec failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_hex(p_window, &y, x_max, p_buf))
+    {
+        fprintf(stderr, "%s: paint_hex failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_time(p_window, &y, x_max, p_buf))
+    {
+        fprintf(stderr, "%s: paint_time failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_seconds(p_window, &y, x_max, p_buf))
+    {
+        fprintf(stderr, "%s: paint_seconds failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_seconds_time(p_window, &y, x_max, p_buf))
+    {
+        fprintf(stderr, "%s: paint_seconds_time failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && paint_base64(p_window, &y, x_max, p_buf, p_buf_end))
+    {
+        fprintf(stderr, "%s: paint_base64 failed\n", __func__);
+        return -1;
+    }
+
+    /* decoded base64 gets the same views as decoded hex */
+    base64_bytes_len = decode_base64(p_buf, p_buf_end, base64_bytes);
+
+    if((y < y_max) && paint_char(p_window, &y, x_max, "64C: ", base64_bytes,
+                base64_bytes_len))
+    {
+        fprintf(stderr, "%s: paint_char failed\n", __func__);
+        return -1;
+    }
+
+    if((y < y_max) && (base64_bytes_len > 0)
+            && paint_ascii(p_window, &y, x_max, "64A: ",
+                (const char *)base64_bytes,
+                (const char *)base64_bytes + base64_bytes_len))
+    {
+        fprintf(stderr, "%s: paint_ascii failed\n", __func__);
+        return -1;
+    }
+
+    /* clear rest of screen */
+    if(ERR == wclrtobot(p_window))
+    {
+        fprintf(stderr, "%s: wclrtobot failed\n", __func__);
+        return -1;
+    }
+
+    /* top row is always painted, so it's already counted */
+    if(p_lines)
+        *p_lines = (y < y_max) ? y : y_max;
+
+    y = 0;  /* fill in top row */
+    if((y < y_max) && paint_string(p_window, &y, x_max, p_buf))
+    {
+        fprintf(stderr, "%s: paint_string failed\n", __func__);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * Read characters and print many different interpretations.
+ * @param p_window  pointer to window to use
+ */
+int main_int(WINDOW *p_window)
+{
+    int c;
+    char buf[BUF_SIZE];
+    char *p_buf;
+
+    /* configure curses */
+
+    if(ERR == cbreak())
+    {
+        fprintf(stderr, "%s: cbreak failed\n", __func__);
+        return -1;
+    }
+
+    if(ERR == noecho())
+    {
+        fprintf(stderr, "%s: noecho failed\n", __func__);
+        return -1;
+    }
+
+    if(ERR == nonl())
+    {
+        fprintf(stderr, "%s: nonl failed\n", __func__);
+        return -1;
+    }
+
+    if(ERR == intrflush(p_window, FALSE))
+    {
+        fprintf(stderr, "%s: intrflush failed\n", __func__);
+        return -1;
+    }
+
+    if(ERR == keypad(p_window, TRUE))
+    {
+        fprintf(stderr, "%s: keypad failed\n", __func__);
+        return -1;
+    }
+
+    /* initial, empty paint */
     p_buf = buf;
     *p_buf = '\0';
-    if(paint_window(p_window, buf, p_buf))
+    if(paint_window(p_window, buf, p_buf, NULL))
     {
         fprintf(stderr, "%s: paint_window failed\n", __func__);
         return -1;
     }
 
+    /* draw to screen */
+    if(ERR == wrefresh(p_window))
+    {
+        fprintf(stderr, "%s: wrefresh failed\n", __func__);
+        return -1;
+    }
+
     /* while there are more characters to get */
     while(ERR != (c = wgetch(p_window)))
     {
@@ -699,23 +1233,923 @@ int main_int(WINDOW *p_window)
         }
 
         /* repaint */
-        if(paint_window(p_window, buf, p_buf))
+        if(paint_window(p_window, buf, p_buf, NULL))
         {
             fprintf(stderr, "%s: paint_window failed\n", __func__);
             return -1;
         }
+
+        /* draw to screen */
+        if(ERR == wrefresh(p_window))
+        {
+            fprintf(stderr, "%s: wrefresh failed\n", __func__);
+            return -1;
+        }
     }
 
     return 0;
 }
 
 /**
- * Read characters and print many different interpretations.
+ * Print the lines painted to a window to stdout, followed by a blank line.
+ * @param p_window  pointer to window to print
+ * @param lines number of lines painted, from paint_window()
+ * @return 0 if no errors; !0 otherwise
  */
-int main(void)
+int print_window(WINDOW *p_window, int lines)
 {
-    WINDOW *p_window;
-    int rc;
+    int y;
+    int y_max;
+    int x_max;
+    char buf[PRINT_COLS + 1 /*NUL byte*/];
+
+    getmaxyx(p_window, y_max, x_max);
+    if(x_max > PRINT_COLS)
+        x_max = PRINT_COLS;
+
+    if(lines > y_max)
+        lines = y_max;
+
+    for(y = 0; y < lines; ++y)
+    {
+        int len;
+
+        if(ERR == (len = mvwinnstr(p_window, y, 0 /*start of line*/, buf,
+                        x_max)))
+        {
+            fprintf(stderr, "%s: mvwinnstr failed\n", __func__);
+            return -1;
+        }
+
+        /* trim the cleared end of the line */
+        while((len > 0) && (buf[len - 1] == ' '))
+            --len;
+
+        if(printf("%.*s\n", len, buf) < 0)
+        {
+            fprintf(stderr, "%s: printf failed\n", __func__);
+            return -1;
+        }
+    }
+
+    if(EOF == putchar('\n'))
+    {
+        fprintf(stderr, "%s: putchar failed\n", __func__);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * Split data into lines and print each one's interpretations to stdout.
+ * Characters after the last newline are carried over to the next call.
+ * @param p_window  pointer to off-screen window to paint to
+ * @param p_data    pointer to data to convert
+ * @param data_len  number of bytes in p_data
+ * @param buf   carry buffer, holds the current line
+ * @param pp_buf    pointer to the NUL byte that terminates buf, updated as
+ *                  characters are carried
+ * @return 0 if no errors; !0 otherwise
+ */
+int convert_lines(WINDOW *p_window, const char *p_data, size_t data_len,
+        char *buf, char **pp_buf)
+{
+    const char *p_data_end;
+    int lines;
+    int cols;
+
+    for(p_data_end = p_data + data_len; p_data < p_data_end; ++p_data)
+    {
+        switch(*p_data)
+        {
+            case '\n':
+            {
+                if(*pp_buf == buf)
+                    break;
+
+                /* only as wide as the widest interpretation, the hex of the
+                 * line, so there's little to clear and copy back out */
+                cols = ((*pp_buf - buf) * 2) + 8 /*prefix*/;
+                if(cols < PRINT_COLS_MIN)
+                    cols = PRINT_COLS_MIN;
+                if((cols != getmaxx(p_window))
+                        && (ERR == wresize(p_window, PRINT_LINES, cols)))
+                {
+                    fprintf(stderr, "%s: wresize failed\n", __func__);
+                    return -1;
+                }
+
+                /* print and clear the buffer */
+                if(paint_window(p_window, buf, *pp_buf, &lines)
+                        || print_window(p_window, lines))
+                {
+                    fprintf(stderr, "%s: paint_window failed\n", __func__);
+                    return -1;
+                }
+
+                *pp_buf = buf;
+                **pp_buf = '\0';
+
+                break;
+            }
+
+            case '\r':
+            case '\0':
+                break;
+
+            default:
+            {
+                /* drop the rest of lines that are too long */
+                if(*pp_buf >= (buf + BUF_SIZE - 1 /* NUL byte */))
+                    continue;
+
+                /* add char onto end of buf */
+                **pp_buf = *p_data;
+                ++*pp_buf;
+                **pp_buf = '\0';
+
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+/**
+ * Read and convert everything appended to a file since the last read.  If
+ * the file shrank, it was truncated, so start over from its beginning.
+ * @param p_window  pointer to off-screen window to paint to
+ * @param fd    file to read
+ * @param buf   carry buffer, holds the current line
+ * @param pp_buf    pointer to the NUL byte that terminates buf
+ * @return 0 if no errors; !0 otherwise
+ */
+int follow_read(WINDOW *p_window, int fd, char *buf, char **pp_buf)
+{
+    struct stat st;
+    off_t offset;
+    char data[65536];
+    ssize_t data_len;
+
+    if(fstat(fd, &st))
+    {
+        fprintf(stderr, "%s: fstat failed: %s\n", __func__, strerror(errno));
+        return -1;
+    }
+
+    if((offset = lseek(fd, 0, SEEK_CUR)) < 0)
+    {
+        fprintf(stderr, "%s: lseek failed: %s\n", __func__, strerror(errno));
+        return -1;
+    }
+
+    /* if truncated, drop the partial line and reread from the start */
+    if(S_ISREG(st.st_mode) && (st.st_size < offset))
+    {
+        if(lseek(fd, 0, SEEK_SET) < 0)
+        {
+            fprintf(stderr, "%s: lseek failed: %s\n", __func__,
+                    strerror(errno));
+            return -1;
+        }
+
+        *pp_buf = buf;
+        **pp_buf = '\0';
+    }
+
+    while(0 != (data_len = read(fd, data, sizeof(data))))
+    {
+        if(data_len < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            fprintf(stderr, "%s: read failed: %s\n", __func__,
+                    strerror(errno));
+            return -1;
+        }
+
+        if(convert_lines(p_window, data, data_len, buf, pp_buf))
+        {
+            fprintf(stderr, "%s: convert_lines failed\n", __func__);
+            return -1;
+        }
+    }
+
+    /* show appended lines right away */
+    if(EOF == fflush(stdout))
+    {
+        fprintf(stderr, "%s: fflush failed\n", __func__);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * Convert the lines of a file, then wait for and convert lines appended to
+ * it.  Truncation is followed by starting over, and rotation by switching
+ * to the new file of the same name.
+ * @param p_window  pointer to off-screen window to paint to
+ * @param p_path    pointer to path of the file to follow
+ * @return 0 if no errors; !0 otherwise
+ */
+int main_follow(WINDOW *p_window, const char *p_path)
+{
+    char dir[PATH_MAX];
+    char base[PATH_MAX];
+    const char *p_base;
+    int inotify_fd;
+    int dir_wd;
+    int file_wd;
+    int fd;
+    char buf[BUF_SIZE];
+    char *p_buf;
+    char events[sizeof(struct inotify_event) + NAME_MAX + 1]
+        __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t events_len;
+    int rc;
+
+    /* dirname() and basename() may modify their arguments */
+    if((snprintf(dir, sizeof(dir), "%s", p_path) >= (int)sizeof(dir))
+            || (snprintf(base, sizeof(base), "%s", p_path)
+                >= (int)sizeof(base)))
+    {
+        fprintf(stderr, "%s: path too long\n", __func__);
+        return -1;
+    }
+    p_base = basename(base);
+
+    if((fd = open(p_path, O_RDONLY)) < 0)
+    {
+        fprintf(stderr, "%s: open %s failed: %s\n", __func__, p_path,
+                strerror(errno));
+        return -1;
+    }
+
+    rc = -1;
+    if((inotify_fd = inotify_init()) < 0)
+    {
+        fprintf(stderr, "%s: inotify_init failed: %s\n", __func__,
+                strerror(errno));
+        goto out_fd;
+    }
+
+    /* watch the directory to catch the file being recreated on rotation */
+    if(((dir_wd = inotify_add_watch(inotify_fd, dirname(dir),
+                        IN_CREATE | IN_MOVED_TO)) < 0)
+            || ((file_wd = inotify_add_watch(inotify_fd, p_path,
+                        IN_MODIFY)) < 0))
+    {
+        fprintf(stderr, "%s: inotify_add_watch failed: %s\n", __func__,
+                strerror(errno));
+        goto out_inotify;
+    }
+
+    /* convert existing contents */
+    p_buf = buf;
+    *p_buf = '\0';
+    if(follow_read(p_window, fd, buf, &p_buf))
+    {
+        fprintf(stderr, "%s: follow_read failed\n", __func__);
+        goto out_inotify;
+    }
+
+    /* block until the file or its directory changes */
+    while(0 != (events_len = read(inotify_fd, events, sizeof(events))))
+    {
+        char *p_event;
+        struct inotify_event *p_inotify_event;
+
+        if(events_len < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            fprintf(stderr, "%s: read failed: %s\n", __func__,
+                    strerror(errno));
+            goto out_inotify;
+        }
+
+        for(p_event = events; p_event < (events + events_len);
+                p_event += sizeof(*p_inotify_event) + p_inotify_event->len)
+        {
+            int new_fd;
+
+            p_inotify_event = (struct inotify_event *)p_event;
+
+            if((p_inotify_event->wd == file_wd)
+                    && (p_inotify_event->mask & IN_MODIFY))
+            {
+                if(follow_read(p_window, fd, buf, &p_buf))
+                {
+                    fprintf(stderr, "%s: follow_read failed\n", __func__);
+                    goto out_inotify;
+                }
+                continue;
+            }
+
+            /* ignore everything but the file being (re)created */
+            if((p_inotify_event->wd != dir_wd) || !p_inotify_event->len
+                    || strcmp(p_inotify_event->name, p_base))
+                continue;
+
+            /* may have already been rotated away again */
+            if((new_fd = open(p_path, O_RDONLY)) < 0)
+                continue;
+
+            /* finish off the old file, ending its last line even if it
+             * has no newline, then switch to the new one */
+            if(follow_read(p_window, fd, buf, &p_buf)
+                    || convert_lines(p_window, "\n", 1, buf, &p_buf))
+            {
+                fprintf(stderr, "%s: follow_read failed\n", __func__);
+                close(new_fd);
+                goto out_inotify;
+            }
+            close(fd);
+            fd = new_fd;
+
+            inotify_rm_watch(inotify_fd, file_wd);
+            if((file_wd = inotify_add_watch(inotify_fd, p_path,
+                            IN_MODIFY)) < 0)
+            {
+                fprintf(stderr, "%s: inotify_add_watch failed: %s\n",
+                        __func__, strerror(errno));
+                goto out_inotify;
+            }
+
+            if(follow_read(p_window, fd, buf, &p_buf))
+            {
+                fprintf(stderr, "%s: follow_read failed\n", __func__);
+                goto out_inotify;
+            }
+        }
+    }
+
+    rc = 0;
+
+out_inotify:
+    close(inotify_fd);
+out_fd:
+    close(fd);
+    return rc;
+}
+
+#else  /* HAVE_SYS_INOTIFY_H */
+
+/**
+ * Following files needs inotify, so report that it isn't supported.
+ * @param p_window  pointer to off-screen window to paint to
+ * @param p_path    pointer to path of the file to follow
+ * @return !0
+ */
+int main_follow(WINDOW *p_window, const char *p_path)
+{
+    (void)p_window;
+    fprintf(stderr, "%s: %s: following files is not supported\n", __func__,
+            p_path);
+    return -1;
+}
+
+#endif  /* HAVE_SYS_INOTIFY_H */
+
+/**
+ * Add an encoding to the patterns being searched for, unless it's a
+ * duplicate of one that's already there.
+ * @param p_patterns    pointer to patterns
+ * @param p_patterns_len    pointer to number of patterns, will be
+ *                          incremented if pattern was added
+ * @param p_name    pointer to name of the encoding
+ * @param p_buf pointer to bytes to search for
+ * @param len   number of bytes in p_buf
+ */
+void find_add_pattern(struct find_pattern *p_patterns, int *p_patterns_len,
+        const char *p_name, const void *p_buf, size_t len)
+{
+    int i;
+
+    if(!len || (len > sizeof(p_patterns->buf))
+            || (*p_patterns_len >= FIND_PATTERNS))
+        return;
+
+    for(i = 0; i < *p_patterns_len; ++i)
+    {
+        if((p_patterns[i].len == len) && !memcmp(p_patterns[i].buf, p_buf, len))
+            return;
+    }
+
+    p_patterns[i].p_name = p_name;
+    memcpy(p_patterns[i].buf, p_buf, len);
+    p_patterns[i].len = len;
+    ++*p_patterns_len;
+}
+
+/**
+ * Parse a value and generate every encoding of it that conv knows: hex in
+ * both cases, decimal, raw little and big endian bytes of the narrowest
+ * integer that holds it, and the time it is as seconds since epoch.
+ * @param p_value   pointer to value, optionally negative, in decimal, hex
+ *                  with 0x, octal with a leading 0, or hex without 0x if
+ *                  it isn't one of those
+ * @param p_patterns    pointer to array of FIND_PATTERNS patterns to fill
+ * @return number of patterns if no errors; -1 otherwise
+ */
+int find_patterns(const char *p_value, struct find_pattern *p_patterns)
+{
+    const char *p_digits;
+    char *p_value_parse_end;
+    unsigned long long val;
+    long long val_signed;
+    int negative;
+    int bytes_len;
+    unsigned char le[8];
+    unsigned char be[8];
+    char buf[FIND_PATTERN_SIZE];
+    time_t val_time;
+    const char *p_time_str;
+    int patterns_len;
+    int i;
+
+    /* only a single leading '-', no whitespace or other signs */
+    negative = (*p_value == '-');
+    p_digits = p_value + negative;
+    if(!isxdigit((unsigned char)*p_digits))
+    {
+        fprintf(stderr, "%s: %s is not a number\n", __func__, p_value);
+        return -1;
+    }
+
+    /* read value as number */
+    errno = 0;
+    val = strtoull(p_digits, &p_value_parse_end, 0 /*base*/);
+
+    /* fall back to hex without 0x, but never for what looks like octal */
+    if((*p_value_parse_end != '\0') && (*p_digits != '0')
+            && (p_digits[strspn(p_digits, "0123456789abcdefABCDEF")]
+                == '\0'))
+    {
+        errno = 0;
+        val = strtoull(p_digits, &p_value_parse_end, 16 /*base*/);
+    }
+
+    if((p_digits == p_value_parse_end) || (*p_value_parse_end != '\0')
+            || (errno == ERANGE)
+            || (negative && (val > (unsigned long long)LLONG_MAX + 1)))
+    {
+        fprintf(stderr, "%s: %s is not a number\n", __func__, p_value);
+        return -1;
+    }
+
+    if(negative)
+        val = -val;
+    val_signed = (long long)val;
+
+    /* find the narrowest integer that holds the value */
+    for(bytes_len = 1; bytes_len < 8; bytes_len *= 2)
+    {
+        int bits;
+
+        bits = bytes_len * 8;
+        if(negative ? (val_signed >= -(1LL << (bits - 1)))
+                : (val < (1ULL << bits)))
+            break;
+    }
+    if(bytes_len < 8)
+        val &= (1ULL << (bytes_len * 8)) - 1;
+
+    patterns_len = 0;
+
+    /* text encodings */
+    if(snprintf(buf, sizeof(buf), "%llx", val) < 0)
+    {
+        fprintf(stderr, "%s: snprintf failed\n", __func__);
+        return -1;
+    }
+    find_add_pattern(p_patterns, &patterns_len, "hex", buf, strlen(buf));
+
+    if(snprintf(buf, sizeof(buf), "%llX", val) < 0)
+    {
+        fprintf(stderr, "%s: snprintf failed\n", __func__);
+        return -1;
+    }
+    find_add_pattern(p_patterns, &patterns_len, "HEX", buf, strlen(buf));
+
+    if((negative ? snprintf(buf, sizeof(buf), "%lld", val_signed)
+                : snprintf(buf, sizeof(buf), "%llu", val)) < 0)
+    {
+        fprintf(stderr, "%s: snprintf failed\n", __func__);
+        return -1;
+    }
+    find_add_pattern(p_patterns, &patterns_len, "dec", buf, strlen(buf));
+
+    /* show how the value was read, since it may be ambiguous */
+    fprintf(stderr, "%s: searching for %s (0x%llx)\n", __func__, buf, val);
+
+    /* raw byte encodings */
+    for(i = 0; i < bytes_len; ++i)
+    {
+        le[i] = (unsigned char)(val >> (i * 8));
+        be[bytes_len - 1 - i] = le[i];
+    }
+    find_add_pattern(p_patterns, &patterns_len, "le", le, bytes_len);
+    find_add_pattern(p_patterns, &patterns_len, "be", be, bytes_len);
+
+    /* time encoding, without ctime's trailing newline */
+    if(!negative && (val > LLONG_MAX))
+        return patterns_len;
+    val_time = (time_t)val_signed;
+    if((p_time_str = ctime(&val_time)))
+        find_add_pattern(p_patterns, &patterns_len, "time", p_time_str,
+                strcspn(p_time_str, "\n"));
+
+    return patterns_len;
+}
+
+/**
+ * Build a matcher that finds all of the patterns in a single pass.
+ * @param p_matcher pointer to matcher to build
+ * @param p_patterns    pointer to patterns to match
+ * @param patterns_len  number of patterns in p_patterns
+ */
+void find_build(struct find_matcher *p_matcher,
+        const struct find_pattern *p_patterns, int patterns_len)
+{
+    unsigned short fail[FIND_STATES];
+    unsigned short queue[FIND_STATES];
+    int queue_head;
+    int queue_tail;
+    int states_len;
+    int i;
+
+    /* build a trie of the patterns, 0 is the root and means no child */
+    memset(p_matcher, 0, sizeof(*p_matcher));
+    states_len = 1;
+    for(i = 0; i < patterns_len; ++i)
+    {
+        size_t j;
+        int state;
+
+        state = 0;
+        for(j = 0; j < p_patterns[i].len; ++j)
+        {
+            unsigned char c;
+
+            c = (unsigned char)p_patterns[i].buf[j];
+            if(!p_matcher->next[state][c])
+                p_matcher->next[state][c] = states_len++;
+            state = p_matcher->next[state][c];
+        }
+        p_matcher->matches[state] |= 1u << i;
+    }
+
+    /* breadth first, point missing transitions where the failure link goes */
+    queue_head = 0;
+    queue_tail = 0;
+    for(i = 0; i <= UCHAR_MAX; ++i)
+    {
+        int child;
+
+        if((child = p_matcher->next[0][i]))
+        {
+            fail[child] = 0;
+            queue[queue_tail++] = child;
+        }
+    }
+
+    while(queue_head < queue_tail)
+    {
+        int state;
+
+        state = queue[queue_head++];
+        for(i = 0; i <= UCHAR_MAX; ++i)
+        {
+            int child;
+
+            if(!(child = p_matcher->next[state][i]))
+            {
+                p_matcher->next[state][i] = p_matcher->next[fail[state]][i];
+                continue;
+            }
+
+            fail[child] = p_matcher->next[fail[state]][i];
+            p_matcher->matches[child] |= p_matcher->matches[fail[child]];
+            queue[queue_tail++] = child;
+        }
+    }
+}
+
+/**
+ * Search a file for all of the patterns and print where each one is found.
+ * @param p_job pointer to job being searched for, stopped if output fails
+ * @param p_path    pointer to path of file to search
+ * @return 0 if no errors; !0 otherwise
+ */
+int find_file(struct find_job *p_job, const char *p_path)
+{
+    int fd;
+    struct stat st;
+    const unsigned char *p_data;
+    size_t data_len;
+    size_t offset;
+    int state;
+
+    if((fd = open(p_path, O_RDONLY)) < 0)
+    {
+        fprintf(stderr, "%s: open %s failed: %s\n", __func__, p_path,
+                strerror(errno));
+        return -1;
+    }
+
+    if(fstat(fd, &st))
+    {
+        fprintf(stderr, "%s: fstat %s failed: %s\n", __func__, p_path,
+                strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    /* only regular files can be mapped */
+    if(!S_ISREG(st.st_mode))
+    {
+        fprintf(stderr, "%s: %s is not a regular file\n", __func__, p_path);
+        close(fd);
+        return -1;
+    }
+
+    /* nothing to map */
+    if(!st.st_size)
+    {
+        close(fd);
+        return 0;
+    }
+
+    data_len = st.st_size;
+    p_data = mmap(NULL, data_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p_data == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: mmap %s failed: %s\n", __func__, p_path,
+                strerror(errno));
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    madvise((void *)p_data, data_len, MADV_SEQUENTIAL);
+
+    /* one table lookup per byte, checking for matches at each */
+    state = 0;
+    for(offset = 0; offset < data_len; ++offset)
+    {
+        unsigned matches;
+        int i;
+
+        state = p_job->p_matcher->next[state][p_data[offset]];
+        if(!(matches = p_job->p_matcher->matches[state]))
+            continue;
+
+        for(i = 0; matches; ++i, matches >>= 1)
+        {
+            if(!(matches & 1))
+                continue;
+
+            if(printf("%s:%llu: %s\n", p_path, (unsigned long long)
+                        (offset + 1 - p_job->p_patterns[i].len),
+                        p_job->p_patterns[i].p_name) < 0)
+            {
+                fprintf(stderr, "%s: printf failed\n", __func__);
+
+                /* no point in searching if matches can't be printed */
+                pthread_mutex_lock(&p_job->mutex);
+                p_job->stop = 1;
+                pthread_mutex_unlock(&p_job->mutex);
+
+                munmap((void *)p_data, data_len);
+                return -1;
+            }
+        }
+    }
+
+    munmap((void *)p_data, data_len);
+    return 0;
+}
+
+/**
+ * Search files from a job until none are left.
+ * @param p_arg pointer to job to search for
+ * @return NULL
+ */
+void *find_thread(void *p_arg)
+{
+    struct find_job *p_job;
+
+    p_job = p_arg;
+    for(;;)
+    {
+        int path;
+
+        int stop;
+
+        /* take the next file */
+        pthread_mutex_lock(&p_job->mutex);
+        path = p_job->paths_next++;
+        stop = p_job->stop;
+        pthread_mutex_unlock(&p_job->mutex);
+
+        if(stop || (path >= p_job->paths_len))
+            break;
+
+        if(find_file(p_job, p_job->pp_paths[path]))
+        {
+            pthread_mutex_lock(&p_job->mutex);
+            p_job->rc = -1;
+            pthread_mutex_unlock(&p_job->mutex);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Search files for every encoding of a value, spreading the files across
+ * one thread per processor.
+ * @param p_value   pointer to value to search for
+ * @param pp_paths  pointer to paths of files to search
+ * @param paths_len number of paths in pp_paths
+ * @return 0 if no errors; !0 otherwise
+ */
+int main_find(const char *p_value, char **pp_paths, int paths_len)
+{
+    struct find_pattern patterns[FIND_PATTERNS];
+    int patterns_len;
+    struct find_matcher *p_matcher;
+    struct find_job job;
+    pthread_t threads[64];
+    long threads_len;
+    long i;
+
+    if((patterns_len = find_patterns(p_value, patterns)) < 0)
+    {
+        fprintf(stderr, "%s: find_patterns failed\n", __func__);
+        return -1;
+    }
+
+    /* too big for the stack */
+    if(!(p_matcher = malloc(sizeof(*p_matcher))))
+    {
+        fprintf(stderr, "%s: malloc failed\n", __func__);
+        return -1;
+    }
+    find_build(p_matcher, patterns, patterns_len);
+
+    job.p_matcher = p_matcher;
+    job.p_patterns = patterns;
+    job.pp_paths = pp_paths;
+    job.paths_len = paths_len;
+    job.paths_next = 0;
+    job.rc = 0;
+    job.stop = 0;
+    if(pthread_mutex_init(&job.mutex, NULL))
+    {
+        fprintf(stderr, "%s: pthread_mutex_init failed\n", __func__);
+        free(p_matcher);
+        return -1;
+    }
+
+    /* no more threads than processors or files */
+    if((threads_len = sysconf(_SC_NPROCESSORS_ONLN)) < 1)
+        threads_len = 1;
+    if(threads_len > (long)(sizeof(threads) / sizeof(threads[0])))
+        threads_len = sizeof(threads) / sizeof(threads[0]);
+    if(threads_len > paths_len)
+        threads_len = paths_len;
+
+    for(i = 0; i < threads_len; ++i)
+    {
+        if(pthread_create(&threads[i], NULL, find_thread, &job))
+        {
+            /* not an error, the threads running take the rest */
+            fprintf(stderr, "%s: pthread_create failed\n", __func__);
+            break;
+        }
+    }
+    threads_len = i;
+
+    /* if no threads could start, search from this one */
+    if(!threads_len)
+        find_thread(&job);
+
+    for(i = 0; i < threads_len; ++i)
+        pthread_join(threads[i], NULL);
+
+    /* matches may still be buffered */
+    if(EOF == fflush(stdout))
+    {
+        fprintf(stderr, "%s: fflush failed\n", __func__);
+        job.rc = -1;
+    }
+
+    pthread_mutex_destroy(&job.mutex);
+    free(p_matcher);
+    return job.rc;
+}
+
+/**
+ * Set up an off-screen window so interpretations can be painted as usual
+ * and then printed to stdout.
+ * @param pp_screen pointer to the new screen, to be passed to delscreen()
+ * @param pp_null   pointer to the screen's output, to be closed after
+ *                  delscreen()
+ * @return pointer to the window if no errors; NULL otherwise
+ */
+WINDOW *init_print(SCREEN **pp_screen, FILE **pp_null)
+{
+    FILE *p_null;
+    WINDOW *p_window;
+
+    /* curses insists on a terminal, so give it one that goes nowhere */
+    if(!(p_null = fopen("/dev/null", "w")))
+    {
+        fprintf(stderr, "%s: fopen failed: %s\n", __func__, strerror(errno));
+        return NULL;
+    }
+
+    if(!(*pp_screen = newterm("dumb", p_null, stdin)))
+    {
+        fprintf(stderr, "%s: newterm failed\n", __func__);
+        fclose(p_null);
+        return NULL;
+    }
+
+    /* a pad is never drawn, so painting it costs nothing extra */
+    if(!(p_window = newpad(PRINT_LINES, PRINT_COLS_MIN)))
+    {
+        fprintf(stderr, "%s: newpad failed\n", __func__);
+        endwin();
+        delscreen(*pp_screen);
+        fclose(p_null);
+        return NULL;
+    }
+
+    *pp_null = p_null;
+    return p_window;
+}
+
+/**
+ * Read characters and print many different interpretations.
+ */
+int main(int argc, char **argv)
+{
+    WINDOW *p_window;
+    SCREEN *p_screen;
+    FILE *p_null;
+    int rc;
+
+    if((argc == 3) && !strcmp(argv[1], "--follow"))
+    {
+        if(!(p_window = init_print(&p_screen, &p_null)))
+        {
+            fprintf(stderr, "%s: init_print failed\n", __func__);
+            return EXIT_FAILURE;
+        }
+
+        /* convert file and whatever is appended to it */
+        rc = main_follow(p_window, argv[2]);
+        delwin(p_window);
+        endwin();
+        delscreen(p_screen);
+        fclose(p_null);
+
+        if(rc)
+        {
+            fprintf(stderr, "%s: main_follow failed\n", __func__);
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    if((argc >= 4) && !strcmp(argv[1], "--find"))
+    {
+        /* search files for the value given */
+        if(main_find(argv[2], argv + 3, argc - 3))
+        {
+            fprintf(stderr, "%s: main_find failed\n", __func__);
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    if(argc != 1)
+    {
+        fprintf(stderr, "usage: %s [--follow FILE | --find VALUE FILE...]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
 
     if(!(p_window = initscr()))
     {